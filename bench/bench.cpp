@@ -0,0 +1,48 @@
+// MIT License
+//
+// Copyright 2023 Tyler Coy
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cassert>
+#include <string>
+#include "bench/bench.h"
+#include "bench/bench_decoder.h"
+#include "bench/bench_crc32.h"
+#include "bench/bench_fifo.h"
+
+namespace quadra::bench
+{
+
+extern "C"
+int main(int argc, char* argv[])
+{
+    assert(argc > 2);
+    auto json_file = std::string(argv[1]);
+    auto bin_file = std::string(argv[2]);
+
+    Report report;
+    decoder::Benchmark(report, bin_file);
+    crc32::Benchmark(report);
+    fifo::Benchmark(report);
+    report.Write(json_file);
+}
+
+}
@@ -0,0 +1,127 @@
+// MIT License
+//
+// Copyright 2023 Tyler Coy
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstdint>
+#include <cassert>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+
+namespace quadra::bench
+{
+
+// Collects benchmark results and writes them out as a JSON array with one
+// object per measurement.
+class Report
+{
+public:
+    void Begin(std::string name)
+    {
+        records_.emplace_back();
+        Add("name", name);
+    }
+
+    void Add(std::string key, std::string value)
+    {
+        std::stringstream ss;
+        ss << "\"" << value << "\"";
+        records_.back().push_back({key, ss.str()});
+    }
+
+    // Without this, a string literal would convert to bool rather than
+    // std::string.
+    void Add(std::string key, const char* value)
+    {
+        Add(key, std::string(value));
+    }
+
+    void Add(std::string key, double value)
+    {
+        std::stringstream ss;
+        ss.precision(std::numeric_limits<double>::max_digits10);
+        ss << value;
+        records_.back().push_back({key, ss.str()});
+    }
+
+    void Add(std::string key, bool value)
+    {
+        records_.back().push_back({key, value ? "true" : "false"});
+    }
+
+    void Write(std::string file_path)
+    {
+        std::ofstream out;
+        out.open(file_path, std::ios::out);
+        assert(out.good());
+        out << "[" << std::endl;
+
+        for (uint32_t i = 0; i < records_.size(); i++)
+        {
+            out << "    {";
+
+            for (uint32_t j = 0; j < records_[i].size(); j++)
+            {
+                auto& [key, value] = records_[i][j];
+                out << (j ? ", " : "") << "\"" << key << "\": " << value;
+            }
+
+            out << ((i + 1 < records_.size()) ? "}," : "}") << std::endl;
+        }
+
+        out << "]" << std::endl;
+        out.close();
+    }
+
+protected:
+    using Record = std::vector<std::pair<std::string, std::string>>;
+    std::vector<Record> records_;
+};
+
+// Returns the shortest of several timed runs of the given function, in
+// seconds. The setup function is called before each run, untimed.
+template <typename S, typename F>
+double TimeBest(uint32_t repetitions, S setup, F function)
+{
+    using Clock = std::chrono::steady_clock;
+    double best = std::numeric_limits<double>::infinity();
+
+    for (uint32_t i = 0; i < repetitions; i++)
+    {
+        setup();
+        auto start = Clock::now();
+        function();
+        std::chrono::duration<double> elapsed = Clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+
+    return best;
+}
+
+}
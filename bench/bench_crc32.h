@@ -0,0 +1,86 @@
+// MIT License
+//
+// Copyright 2023 Tyler Coy
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+#include "bench/bench.h"
+#include "quadra/inc/crc32.h"
+
+namespace quadra::bench::crc32
+{
+
+constexpr uint32_t kTestLength = 1 << 24;
+constexpr uint32_t kRepetitions = 5;
+
+inline void Record(Report& report, std::string implementation,
+    double seconds, bool ok)
+{
+    double bytes_per_second = kTestLength / seconds;
+    double ns_per_byte = seconds * 1e9 / kTestLength;
+
+    std::printf("CRC32 (%s): %8.1f MB/s, %6.3f ns/byte%s\n",
+        implementation.c_str(), bytes_per_second * 1e-6, ns_per_byte,
+        ok ? "" : " (incorrect)");
+
+    report.Begin("crc32");
+    report.Add("implementation", implementation);
+    report.Add("bytes", double(kTestLength));
+    report.Add("bytes_per_second", bytes_per_second);
+    report.Add("ns_per_byte", ns_per_byte);
+    report.Add("ok", ok);
+}
+
+// Compares Crc32 to zlib, the reference used by the unit tests.
+inline void Benchmark(Report& report)
+{
+    std::vector<uint8_t> data(kTestLength);
+    std::minstd_rand rng;
+    std::uniform_int_distribution<uint8_t> dist(0, 0xFF);
+    rng.seed(0);
+
+    for (auto& byte : data)
+    {
+        byte = dist(rng);
+    }
+
+    uint32_t expected;
+    double seconds = TimeBest(kRepetitions, [](void) {},
+        [&](void) { expected = ::crc32(0, data.data(), kTestLength); });
+    Record(report, "zlib", seconds, true);
+
+    Crc32 crc;
+    crc.Init();
+    uint32_t actual;
+    seconds = TimeBest(kRepetitions, [&](void) { crc.Seed(0); },
+        [&](void) { actual = crc.Process(data.data(), kTestLength); });
+    Record(report, "quadra", seconds, actual == expected);
+}
+
+}
@@ -0,0 +1,233 @@
+// MIT License
+//
+// Copyright 2023 Tyler Coy
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+#include "bench/bench.h"
+#include "unit_tests/util.h"
+#include "host/batch_decoder.h"
+#include "quadra/decoder.h"
+
+namespace quadra::bench::decoder
+{
+
+constexpr uint32_t kSampleRate = 48000;
+constexpr uint32_t kCRCSeed = 0;
+constexpr uint32_t kRepetitions = 5;
+constexpr size_t kChunkSize = 256;
+
+using Signal = std::vector<float>;
+
+template <int symbol_duration, int packet_size, int block_size>
+using ParamType = std::tuple<
+    std::integral_constant<int, symbol_duration>,
+    std::integral_constant<int, packet_size>,
+    std::integral_constant<int, block_size>
+    >;
+using ParamTypeList = std::tuple<
+    /*[[[cog
+    import itertools
+    lines = []
+    symbol_duration = (5, 6, 8, 10, 12, 16)
+    sizes = ((128, 8), (256, 4), (1024, 4))
+    configs = itertools.product(symbol_duration, sizes)
+    for (symbol_duration, (packet_size, packets_per_block)) in configs:
+        lines.append('ParamType<{:2}, {:4}, {:4}>'.format(symbol_duration,
+            packet_size, packet_size * packets_per_block))
+    cog.outl(',\n'.join(lines))
+    ]]]*/
+    ParamType< 5,  128, 1024>,
+    ParamType< 5,  256, 1024>,
+    ParamType< 5, 1024, 4096>,
+    ParamType< 6,  128, 1024>,
+    ParamType< 6,  256, 1024>,
+    ParamType< 6, 1024, 4096>,
+    ParamType< 8,  128, 1024>,
+    ParamType< 8,  256, 1024>,
+    ParamType< 8, 1024, 4096>,
+    ParamType<10,  128, 1024>,
+    ParamType<10,  256, 1024>,
+    ParamType<10, 1024, 4096>,
+    ParamType<12,  128, 1024>,
+    ParamType<12,  256, 1024>,
+    ParamType<12, 1024, 4096>,
+    ParamType<16,  128, 1024>,
+    ParamType<16,  256, 1024>,
+    ParamType<16, 1024, 4096>
+    //[[[end]]]
+    >;
+
+template <typename T>
+Result Decode(T& decoder, const Signal& signal)
+{
+    Result result = RESULT_NONE;
+
+    for (auto sample : signal)
+    {
+        decoder.Push(sample);
+        result = decoder.Process();
+
+        if (result == RESULT_ERROR)
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+// Event sink which keeps only the most recent result
+class LastResult
+{
+public:
+    Result result = RESULT_NONE;
+
+    void OnPacket(uint64_t)                { result = RESULT_PACKET_COMPLETE; }
+    void OnBlock(uint64_t, const uint32_t*) { result = RESULT_BLOCK_COMPLETE; }
+    void OnEnd(uint64_t)                   { result = RESULT_END; }
+    void OnError(uint64_t, Error)          { result = RESULT_ERROR; }
+};
+
+template <typename T>
+Result DecodeBatch(host::BatchDecoder<T>& batch, const Signal& signal)
+{
+    LastResult sink;
+
+    for (size_t i = 0; i < signal.size(); i += kChunkSize)
+    {
+        batch.Push(&signal[i], std::min(kChunkSize, signal.size() - i));
+
+        while (batch.samples_available())
+        {
+            batch.ProcessAll(sink);
+
+            if (sink.result == RESULT_END || sink.result == RESULT_ERROR)
+            {
+                return sink.result;
+            }
+        }
+    }
+
+    return sink.result;
+}
+
+template <typename T, typename S, typename F>
+void Measure(Report& report, const char* interface, size_t samples,
+    S setup, F decode)
+{
+    constexpr int kSymbolDuration = std::tuple_element_t<0, T>::value;
+    constexpr int kPacketSize     = std::tuple_element_t<1, T>::value;
+    constexpr int kBlockSize      = std::tuple_element_t<2, T>::value;
+    constexpr int kSymbolRate     = kSampleRate / kSymbolDuration;
+
+    std::printf("Decoder<%5i, %5i, %4i, %4i> %-6s: ",
+        kSampleRate, kSymbolRate, kPacketSize, kBlockSize, interface);
+
+    report.Begin("decoder");
+    report.Add("interface", interface);
+    report.Add("sample_rate", double(kSampleRate));
+    report.Add("symbol_duration", double(kSymbolDuration));
+    report.Add("packet_size", double(kPacketSize));
+    report.Add("block_size", double(kBlockSize));
+    report.Add("samples", double(samples));
+
+    // Without any samples, there's nothing to time
+    if (samples == 0)
+    {
+        std::printf("no samples\n");
+        report.Add("ok", false);
+        return;
+    }
+
+    Result result = RESULT_NONE;
+    double seconds = TimeBest(kRepetitions, setup,
+        [&](void) { result = decode(); });
+
+    // A failed decode may have stopped partway through the signal, so its
+    // rates would be meaningless and are left out.
+    bool ok = (result == RESULT_END);
+    report.Add("ok", ok);
+
+    if (!ok)
+    {
+        std::printf("decoding failed\n");
+        return;
+    }
+
+    double samples_per_second = samples / seconds;
+    double realtime_factor = samples_per_second / kSampleRate;
+    double ns_per_sample = seconds * 1e9 / samples;
+
+    std::printf("%12.0f samples/s, %8.1fx real time, %7.2f ns/sample\n",
+        samples_per_second, realtime_factor, ns_per_sample);
+
+    report.Add("samples_per_second", samples_per_second);
+    report.Add("realtime_factor", realtime_factor);
+    report.Add("ns_per_sample", ns_per_sample);
+}
+
+template <typename T>
+void Run(Report& report, std::string bin_file)
+{
+    constexpr int kSymbolDuration = std::tuple_element_t<0, T>::value;
+    constexpr int kPacketSize     = std::tuple_element_t<1, T>::value;
+    constexpr int kBlockSize      = std::tuple_element_t<2, T>::value;
+    constexpr int kSymbolRate     = kSampleRate / kSymbolDuration;
+
+    static Decoder<kSampleRate, kSymbolRate, kPacketSize, kBlockSize> decoder;
+    host::BatchDecoder batch(decoder);
+
+    // The encoder's write gaps are irrelevant here since the decoder never
+    // has to pause for flash writes, so make them as short as possible.
+    Signal signal = test::util::LoadAudio<Signal>(bin_file,
+        kSymbolRate, kPacketSize, kBlockSize, 0.002f);
+
+    Measure<T>(report, "sample", signal.size(),
+        [&](void) { decoder.Init(kCRCSeed); },
+        [&](void) { return Decode(decoder, signal); });
+
+    Measure<T>(report, "batch", signal.size(),
+        [&](void) { batch.Init(kCRCSeed); },
+        [&](void) { return DecodeBatch(batch, signal); });
+}
+
+template <typename... T>
+void RunAll(Report& report, std::string bin_file, std::tuple<T...>)
+{
+    (Run<T>(report, bin_file), ...);
+}
+
+inline void Benchmark(Report& report, std::string bin_file)
+{
+    RunAll(report, bin_file, ParamTypeList{});
+}
+
+}
@@ -0,0 +1,103 @@
+// MIT License
+//
+// Copyright 2023 Tyler Coy
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <tuple>
+#include <thread>
+#include <type_traits>
+
+#include "bench/bench.h"
+#include "quadra/inc/fifo.h"
+
+namespace quadra::bench::fifo
+{
+
+constexpr uint32_t kTestLength = 10000000;
+constexpr uint32_t kRepetitions = 3;
+
+// The same sizes as the thread-safety tests
+using FifoSizes = std::tuple<
+    std::integral_constant<uint32_t, 4096>,
+    std::integral_constant<uint32_t, 16>,
+    std::integral_constant<uint32_t, 2>,
+    std::integral_constant<uint32_t, 1>>;
+
+// Measures throughput with a producer and a consumer on separate threads,
+// as in a host pipeline where capture and decoding run concurrently.
+template <typename T>
+void Run(Report& report)
+{
+    constexpr uint32_t kSize = T::value;
+    static Fifo<uint32_t, kSize> fifo;
+    bool ok = true;
+
+    double seconds = TimeBest(kRepetitions, [&](void) { fifo.Init(); },
+        [&](void)
+        {
+            std::thread producer([&](void)
+            {
+                for (uint32_t i = 0; i < kTestLength; i++)
+                {
+                    while (fifo.Push(i) == false);
+                }
+            });
+
+            for (uint32_t i = 0; i < kTestLength; i++)
+            {
+                uint32_t item;
+                while (fifo.Pop(item) == false);
+                ok = ok && (item == i);
+            }
+
+            producer.join();
+        });
+
+    double items_per_second = kTestLength / seconds;
+    double ns_per_item = seconds * 1e9 / kTestLength;
+
+    std::printf("Fifo<uint32_t, %4u>: %12.0f items/s, %7.2f ns/item%s\n",
+        kSize, items_per_second, ns_per_item, ok ? "" : " (out of order)");
+
+    report.Begin("fifo");
+    report.Add("size", double(kSize));
+    report.Add("items", double(kTestLength));
+    report.Add("items_per_second", items_per_second);
+    report.Add("ns_per_item", ns_per_item);
+    report.Add("ok", ok);
+}
+
+template <typename... T>
+void RunAll(Report& report, std::tuple<T...>)
+{
+    (Run<T>(report), ...);
+}
+
+inline void Benchmark(Report& report)
+{
+    RunAll(report, FifoSizes{});
+}
+
+}
@@ -27,6 +27,7 @@ SYMBOL_RATE := 9600
 PACKET_SIZE := 256
 BLOCK_SIZE := 0x4000
 CRC_SEED := 420
+PROFILE_CYCLES := 0
 
 TARGET := example.elf
 SOURCES := example/*.cpp example/hal/*.c
@@ -47,6 +48,7 @@ TGT_DEFS := \
 	PACKET_SIZE=$(PACKET_SIZE) \
 	BLOCK_SIZE=$(BLOCK_SIZE) \
 	CRC_SEED=$(CRC_SEED) \
+	PROFILE_CYCLES=$(PROFILE_CYCLES) \
 
 ARCHFLAGS := \
 	-mthumb \
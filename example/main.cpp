@@ -48,6 +48,94 @@ constexpr uint32_t kCRCSeed = CRC_SEED;
 
 quadra::Decoder<kSampleRate, kSymbolRate, kPacketSize, kBlockSize> decoder;
 
+void InitCycleCounter(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+#if PROFILE_CYCLES
+struct CycleCount
+{
+    uint32_t calls;
+    uint32_t max;
+    uint64_t total;
+};
+
+// The cycles spent pushing samples and processing them are tallied here for
+// inspection with a debugger. Calls to Decoder::Process() are broken down by
+// their result: most calls only demodulate a sample, but those that complete
+// a packet also perform error correction and CRC checking, and those that
+// complete a block also assemble the block.
+struct CycleProfile
+{
+    CycleCount push;
+    CycleCount sample;
+    CycleCount packet;
+    CycleCount block;
+};
+
+CycleProfile cycle_profile;
+
+// Running total of cycles spent in the ADC interrupt, which is allowed to
+// wrap. The ADC interrupt preempts Process(), so the cycles it accrues during
+// a call are subtracted from that call's count. The cycle counter is read
+// outside the interrupt total at both ends, so an interrupt landing between
+// the two reads is never subtracted from a window it fell outside of.
+// Interrupt entry and exit aren't measured either, so a call that was
+// preempted may still be slightly overcounted, but never undercounted.
+volatile uint32_t isr_cycles;
+
+uint32_t push_start;
+uint32_t process_start;
+uint32_t process_isr_start;
+
+inline void Tally(CycleCount& count, uint32_t cycles)
+{
+    count.calls++;
+    count.total += cycles;
+    count.max = (cycles > count.max) ? cycles : count.max;
+}
+#endif
+
+inline void ProfilePushStart(void)
+{
+#if PROFILE_CYCLES
+    push_start = DWT->CYCCNT;
+#endif
+}
+
+inline void ProfilePushEnd(void)
+{
+#if PROFILE_CYCLES
+    uint32_t cycles = DWT->CYCCNT - push_start;
+    isr_cycles = isr_cycles + cycles;
+    Tally(cycle_profile.push, cycles);
+#endif
+}
+
+inline void ProfileProcessStart(void)
+{
+#if PROFILE_CYCLES
+    process_start = DWT->CYCCNT;
+    process_isr_start = isr_cycles;
+#endif
+}
+
+inline void ProfileProcessEnd([[maybe_unused]] quadra::Result result)
+{
+#if PROFILE_CYCLES
+    uint32_t isr_end = isr_cycles;
+    uint32_t cycles = DWT->CYCCNT - process_start;
+    cycles -= isr_end - process_isr_start;
+
+    Tally((result == quadra::RESULT_PACKET_COMPLETE) ? cycle_profile.packet :
+        (result == quadra::RESULT_BLOCK_COMPLETE) ? cycle_profile.block :
+        cycle_profile.sample, cycles);
+#endif
+}
+
 #ifdef USE_FULL_ASSERT
 extern "C"
 void assert_failed(
@@ -70,6 +158,7 @@ void SysTick_Handler(void)
 void ADC_IRQHandler(void)
 {
     LL_GPIO_SetOutputPin(GPIOD, kADCInterruptPin);
+    ProfilePushStart();
 
     // Get the sample from the ADC, convert to float, and pass it to the
     // decoder.
@@ -77,6 +166,7 @@ void ADC_IRQHandler(void)
     float sample = (data - 0x800) / 2048.f;
     decoder.Push(sample);
 
+    ProfilePushEnd();
     LL_GPIO_ResetOutputPin(GPIOD, kADCInterruptPin);
 }
 
@@ -313,6 +403,7 @@ int main(void)
     InitPowerAndClock();
     InitTimer();
     InitADC();
+    InitCycleCounter();
     decoder.Init(kCRCSeed);
     __enable_irq();
 
@@ -334,7 +425,9 @@ int main(void)
         while (!decoder.samples_available());
 
         LL_GPIO_SetOutputPin(GPIOD, kProfilingPin);
+        ProfileProcessStart();
         auto result = decoder.Process();
+        ProfileProcessEnd(result);
         LL_GPIO_ResetOutputPin(GPIOD, kProfilingPin);
 
         if (result == quadra::RESULT_PACKET_COMPLETE)
@@ -0,0 +1,201 @@
+// MIT License
+//
+// Copyright 2023 Tyler Coy
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "quadra/decoder.h"
+
+namespace quadra::host
+{
+
+struct Event
+{
+    Result result;
+    uint64_t offset;
+    Error error;
+};
+
+// An event sink receives the results of processing as inline calls to its
+// OnPacket(), OnBlock(), OnEnd(), and OnError() methods, each with the offset
+// of the sample that produced the result. OnBlock() also receives the block
+// data, which remains valid until processing resumes, and OnError() receives
+// the error, so a sink needs no reference to the decoder. This one collects
+// the events in a list.
+class EventList
+{
+public:
+    void OnPacket(uint64_t offset)
+    {
+        events_.push_back({RESULT_PACKET_COMPLETE, offset, ERROR_NONE});
+    }
+
+    void OnBlock(uint64_t offset, const uint32_t*)
+    {
+        events_.push_back({RESULT_BLOCK_COMPLETE, offset, ERROR_NONE});
+    }
+
+    void OnEnd(uint64_t offset)
+    {
+        events_.push_back({RESULT_END, offset, ERROR_NONE});
+    }
+
+    void OnError(uint64_t offset, Error error)
+    {
+        events_.push_back({RESULT_ERROR, offset, error});
+    }
+
+    void Clear(void)
+    {
+        events_.clear();
+    }
+
+    const std::vector<Event>& events(void)
+    {
+        return events_;
+    }
+
+protected:
+    std::vector<Event> events_;
+};
+
+// Drives a decoder with whole buffers of samples rather than one sample at a
+// time. Each call to ProcessAll() consumes as many samples as possible and
+// passes the packet, block, end, and error results it encounters to an event
+// sink, or returns them as a list.
+//
+// Once the decoder reaches the end of the data or an error, it reports that
+// same result on every later call to Process(). The batch decoder reports it
+// only once. After that, it discards pushed samples, reports no samples
+// available, and processes nothing until Init() or Reset() is called.
+template <typename T>
+class BatchDecoder
+{
+public:
+    explicit BatchDecoder(T& decoder) :
+        decoder_(decoder),
+        offset_(0),
+        finished_(false)
+    {
+    }
+
+    // Initialize and reset the decoder through these methods rather than
+    // directly, so that the sample offsets start over along with it.
+    void Init(uint32_t crc_seed)
+    {
+        decoder_.Init(crc_seed);
+        offset_ = 0;
+        finished_ = false;
+        events_.Clear();
+    }
+
+    void Reset(void)
+    {
+        decoder_.Reset();
+        offset_ = 0;
+        finished_ = false;
+        events_.Clear();
+    }
+
+    void Push(const float* samples, size_t length)
+    {
+        if (finished_)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < length; i++)
+        {
+            decoder_.Push(samples[i]);
+        }
+    }
+
+    // Processes every available sample. A completed block, the end of the
+    // data, or an error stops processing early because the caller must
+    // handle those before decoding can continue.
+    template <typename Sink>
+    void ProcessAll(Sink& sink)
+    {
+        while (samples_available())
+        {
+            Result result = decoder_.Process();
+            uint64_t offset = offset_++;
+
+            if (result == RESULT_PACKET_COMPLETE)
+            {
+                sink.OnPacket(offset);
+            }
+            else if (result == RESULT_BLOCK_COMPLETE)
+            {
+                sink.OnBlock(offset, decoder_.block_data());
+                break;
+            }
+            else if (result == RESULT_END)
+            {
+                sink.OnEnd(offset);
+                finished_ = true;
+                break;
+            }
+            else if (result == RESULT_ERROR)
+            {
+                sink.OnError(offset, decoder_.error());
+                finished_ = true;
+                break;
+            }
+        }
+    }
+
+    const std::vector<Event>& ProcessAll(void)
+    {
+        events_.Clear();
+        ProcessAll(events_);
+        return events_.events();
+    }
+
+    bool samples_available(void)
+    {
+        return !finished_ && decoder_.samples_available();
+    }
+
+    // Whether the end of the data or an error has been reported
+    bool finished(void)
+    {
+        return finished_;
+    }
+
+    // Number of samples processed since Init() or Reset()
+    uint64_t offset(void)
+    {
+        return offset_;
+    }
+
+protected:
+    T& decoder_;
+    uint64_t offset_;
+    bool finished_;
+    EventList events_;
+};
+
+}
@@ -26,7 +26,8 @@ TARGET_DIR := $(BUILD_DIR)/artifact
 $(TARGET_DIR):
 	mkdir -p $@
 
-SUBMAKEFILES := test.mk sim-decoder.mk sim-demodulator.mk sim-pll.mk example.mk
+SUBMAKEFILES := test.mk sim-decoder.mk sim-demodulator.mk sim-pll.mk \
+	bench.mk example.mk
 
 .DEFAULT_GOAL := tests
 
@@ -36,4 +37,5 @@ cog:
 	@cog -r quadra/inc/util.h
 	@cog -r unit_tests/test_decoder.cpp
 	@cog -r unit_tests/test_packet.cpp
+	@cog -r bench/bench_decoder.h
 	@cog -r sim/vcd_var.h
@@ -195,7 +195,7 @@ inline Signal Modulate(Symbols symbols)
         {
             break;
         }
-        signal.push_back(sample / 32767.f);
+        signal.push_back(test::util::FromPCM<Signal>(sample));
     }
 
     // Append half a symbol's worth of null samples so that the demodulator
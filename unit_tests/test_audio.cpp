@@ -0,0 +1,48 @@
+// MIT License
+//
+// Copyright 2023 Tyler Coy
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cstdint>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "unit_tests/util.h"
+
+namespace quadra::test::util
+{
+
+TEST(AudioTest, IntegerMatchesFloat)
+{
+    std::string bin_file = "unit_tests/data/data.bin";
+    auto pcm = LoadAudio<std::vector<int16_t>>(bin_file, 8000, 256, 1024);
+
+    ASSERT_FALSE(pcm.empty());
+    ASSERT_LT(*std::min_element(pcm.begin(), pcm.end()), 0);
+
+    for (uint32_t i = 0; i < pcm.size(); i++)
+    {
+        float sample = FromPCM<std::vector<float>>(pcm[i]);
+        ASSERT_EQ(sample, pcm[i] / 32767.f) << "at i = " << i;
+    }
+}
+
+}
@@ -25,10 +25,12 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <algorithm>
 #include <type_traits>
 #include <gtest/gtest.h>
 #include "quadra/decoder.h"
 #include "unit_tests/util.h"
+#include "host/batch_decoder.h"
 
 namespace quadra::test::decoder
 {
@@ -185,6 +187,33 @@ using ParamTypeList = ::testing::Types<
     //[[[end]]]
     >;
 
+inline void UnpackBlock(const uint32_t* block, uint32_t block_size,
+    std::vector<uint8_t>& data)
+{
+    for (uint32_t i = 0; i < block_size / 4; i++)
+    {
+        data.push_back(block[i] >>  0);
+        data.push_back(block[i] >>  8);
+        data.push_back(block[i] >> 16);
+        data.push_back(block[i] >> 24);
+    }
+}
+
+// Event sink which records every event, and copies out each block as it
+// arrives using only the block data passed to it
+template <uint32_t kBlockSize>
+class RecordingSink : public host::EventList
+{
+public:
+    std::vector<uint8_t> data;
+
+    void OnBlock(uint64_t offset, const uint32_t* block)
+    {
+        EventList::OnBlock(offset, block);
+        UnpackBlock(block, kBlockSize, data);
+    }
+};
+
 template <typename T>
 class DecoderTest : public ::testing::Test
 {
@@ -278,13 +307,40 @@ public:
         decoder_.Init(kCRCSeed);
     }
 
-    void Decode(float signal_level, float noise_dB, float resampling_ratio)
+    Signal Impair(float signal_level, float noise_dB, float resampling_ratio)
     {
         Signal signal = test_audio_;
         signal = util::Resample(signal, resampling_ratio);
         signal = util::AddNoise(signal, std::pow(10, noise_dB / 20));
         signal = util::Scale(signal, signal_level);
-        Decode(signal);
+        return signal;
+    }
+
+    void Decode(float signal_level, float noise_dB, float resampling_ratio)
+    {
+        Decode(Impair(signal_level, noise_dB, resampling_ratio));
+    }
+
+    void AppendBlock(std::vector<uint8_t>& data)
+    {
+        UnpackBlock(decoder_.block_data(), kBlockSize, data);
+    }
+
+    void Verify(Result result, const std::vector<uint8_t>& data)
+    {
+        ASSERT_EQ(result, RESULT_END);
+        ASSERT_EQ(data.size(), decoder_.total_size_bytes());
+        ASSERT_FLOAT_EQ(decoder_.progress(), 1.0);
+
+        // Compare the received data to the bin file
+        ASSERT_GE(data.size(), test_data_.size());
+
+        for (uint32_t i = 0; i < data.size(); i++)
+        {
+            uint8_t expected = (i < test_data_.size()) ?
+                test_data_[i] : kFillByte;
+            ASSERT_EQ(data[i], expected) << "at i = " << i;
+        }
     }
 
     void Decode(Signal signal)
@@ -313,14 +369,7 @@ public:
                 }
                 else if (result == RESULT_BLOCK_COMPLETE)
                 {
-                    const uint32_t* block = decoder_.block_data();
-                    for (uint32_t i = 0; i < kBlockSize / 4; i++)
-                    {
-                        data.push_back(block[i] >>  0);
-                        data.push_back(block[i] >>  8);
-                        data.push_back(block[i] >> 16);
-                        data.push_back(block[i] >> 24);
-                    }
+                    AppendBlock(data);
                     flash_write_delay = kSampleRate * kFlashWriteTime;
                     ASSERT_EQ(data.size(), decoder_.bytes_received());
                 }
@@ -331,19 +380,96 @@ public:
             }
         }
 
-        ASSERT_EQ(result, RESULT_END);
-        ASSERT_EQ(data.size(), decoder_.total_size_bytes());
-        ASSERT_FLOAT_EQ(decoder_.progress(), 1.0);
+        Verify(result, data);
+    }
 
-        // Compare the received data to the bin file
-        ASSERT_GE(data.size(), test_data_.size());
+    // Decodes through the batch interface, with events delivered either as
+    // a list or directly to a RecordingSink.
+    void DecodeBatch(Signal signal, bool use_sink)
+    {
+        constexpr uint32_t kChunkSize = 256;
+        host::BatchDecoder batch(decoder_);
+        batch.Init(kCRCSeed);
+        uint64_t pushed = 0;
+        uint64_t resume = 0;
 
-        for (uint32_t i = 0; i < data.size(); i++)
+        ASSERT_EQ(decoder_.bytes_received(), 0);
+        ASSERT_EQ(decoder_.total_size_bytes(), 0);
+        ASSERT_FLOAT_EQ(decoder_.progress(), 0.0);
+
+        // Begin decoding. After each block, processing is suspended for the
+        // same number of samples as in Decode() above. Unlike Decode(), which
+        // never catches up and so carries a growing backlog from block to
+        // block, ProcessAll() drains the FIFO whenever processing resumes.
+        // This test therefore puts much less load on the FIFO.
+        Result result = RESULT_NONE;
+        std::vector<uint8_t> data;
+        RecordingSink<kBlockSize> sink;
+        uint64_t last_offset = 0;
+        bool first_event = true;
+        while (pushed < signal.size())
         {
-            uint8_t expected = (i < test_data_.size()) ?
-                test_data_[i] : kFillByte;
-            ASSERT_EQ(data[i], expected) << "at i = " << i;
+            uint64_t length = std::min<uint64_t>(kChunkSize,
+                signal.size() - pushed);
+
+            if (pushed < resume)
+            {
+                length = std::min(length, resume - pushed);
+            }
+
+            batch.Push(&signal[pushed], length);
+            pushed += length;
+
+            if (pushed < resume)
+            {
+                continue;
+            }
+
+            std::vector<host::Event> events;
+
+            if (use_sink)
+            {
+                sink.Clear();
+                batch.ProcessAll(sink);
+                events = sink.events();
+            }
+            else
+            {
+                events = batch.ProcessAll();
+            }
+
+            for (auto& event : events)
+            {
+                // Events must arrive in sample order, and nothing may follow
+                // the end of the data.
+                ASSERT_NE(result, RESULT_END) << "at offset " << event.offset;
+                ASSERT_TRUE(first_event || event.offset > last_offset)
+                    << "at offset " << event.offset;
+                first_event = false;
+                last_offset = event.offset;
+                result = event.result;
+
+                if (result == RESULT_ERROR)
+                {
+                    ASSERT_EQ(event.error, decoder_.error());
+                    ReceiveError(event.error);
+                    FAIL() << "at offset " << event.offset;
+                }
+                else if (result == RESULT_BLOCK_COMPLETE)
+                {
+                    if (!use_sink)
+                    {
+                        AppendBlock(data);
+                    }
+
+                    resume = event.offset + 1 + kSampleRate * kFlashWriteTime;
+                    ASSERT_EQ((use_sink ? sink.data : data).size(),
+                        decoder_.bytes_received());
+                }
+            }
         }
+
+        Verify(result, use_sink ? sink.data : data);
     }
 };
 
@@ -357,6 +483,40 @@ TYPED_TEST(DecoderTest, Decode)
     this->Decode(scale, noise_dB, resampling_ratio);
 }
 
+// The batch interface is exercised on a subset of the parameter space, since
+// its demodulation is identical to that of the per-sample interface.
+using BatchParamTypeList = ::testing::Types<
+    ParamType< 5,  -30, 0,  50000>,
+    ParamType< 8,  -30, 1, -50000>,
+    ParamType<16,  -30, 0,      0>
+    >;
+
+template <typename T>
+class DecoderBatchTest : public DecoderTest<T>
+{
+public:
+    void Run(bool use_sink)
+    {
+        float scale = this->kInvert ? -1 : 1;
+        float noise_dB = this->kNoise_dB;
+        float resampling_ratio = 1 + this->kMismatchPPM * 1e-6;
+        this->DecodeBatch(this->Impair(scale, noise_dB, resampling_ratio),
+            use_sink);
+    }
+};
+
+TYPED_TEST_CASE(DecoderBatchTest, BatchParamTypeList);
+
+TYPED_TEST(DecoderBatchTest, Decode)
+{
+    this->Run(false);
+}
+
+TYPED_TEST(DecoderBatchTest, Sink)
+{
+    this->Run(true);
+}
+
 
 
 class HangTest : public ::testing::Test
@@ -30,6 +30,7 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <type_traits>
 #include <samplerate.h>
 
 namespace quadra::test::util
@@ -131,6 +132,24 @@ T Clamp(T signal, float low, float high)
     return signal;
 }
 
+// Converts a 16-bit PCM sample to the element type of the container T.
+// Containers of integers receive the raw PCM value, with no conversion, so
+// they must be signed.
+template <typename T>
+typename T::value_type FromPCM(int16_t sample)
+{
+    if constexpr (std::is_integral_v<typename T::value_type>)
+    {
+        static_assert(std::is_signed_v<typename T::value_type>,
+            "PCM samples must be loaded into a signed integer type");
+        return sample;
+    }
+    else
+    {
+        return sample / 32767.f;
+    }
+}
+
 template <typename T>
 T LoadAudio(std::string file_path)
 {
@@ -147,7 +166,7 @@ T LoadAudio(std::string file_path)
         {
             break;
         }
-        signal.push_back(sample / 32767.f);
+        signal.push_back(FromPCM<T>(sample));
     }
     wav_file.close();
     return signal;
@@ -172,7 +191,7 @@ T LoadAudioFromCommand(std::string command)
         {
             break;
         }
-        signal.push_back(sample / 32767.f);
+        signal.push_back(FromPCM<T>(sample));
     }
 
     pclose(wav_file);